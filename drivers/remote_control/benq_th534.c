@@ -8,19 +8,12 @@
 
 #include <drivers/remote_control.h>
 #include <drivers/ir_led_sequencer.h>
+#include <remote_control_encoding/nec.h>
 
 LOG_MODULE_REGISTER(remote_control_benq_th534, CONFIG_REMOTE_CONTROL_LOG_LEVEL);
 
-// The NEC protocol uses pulse distance encoding, thus the sequences have a different length
-// and each sequence slot takes 562.5 us
-static const bool NEC_SEQUENCE_ENCODED_0[] = {true, false};
-static const bool NEC_SEQUENCE_ENCODED_1[] = {true, false, false, false};
-static const bool NEC_SEQUENCE_ENCODED_SPACE[] = {false, false, false, false, false, false, false, false};
-static const bool NEC_SEQUENCE_ENCODED_AGC[] = {true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true};
-static const bool NEC_SEQUENCE_ENCODED_STOP[] = {true, false};
-
- struct remote_control_benq_th534_data {
-	bool sequence[sizeof(NEC_SEQUENCE_ENCODED_AGC) + sizeof(NEC_SEQUENCE_ENCODED_SPACE) + sizeof(NEC_SEQUENCE_ENCODED_1)*8*4 + sizeof(NEC_SEQUENCE_ENCODED_STOP)];
+struct remote_control_benq_th534_data {
+	bool sequence[NEC_SEQUENCE_MAX_LENGTH];
 	size_t seq_fill_index;
 };
 
@@ -28,42 +21,6 @@ struct remote_control_benq_th534_config {
 	const struct device* ir_led_sequencer;
 };
 
-static int remote_control_write_slots_to_sequence(struct remote_control_benq_th534_data* rc_data, const bool* slots, size_t length) {
-    if (rc_data->seq_fill_index + length > sizeof(rc_data->sequence)) {
-		printk("Sequence buffer overflow");
-		return -ENOBUFS;
-    }
-
-    memcpy(&rc_data->sequence[rc_data->seq_fill_index], slots, length);
-    rc_data->seq_fill_index += length;
-    // printk("Writing %x (%u)\n", slots, length);
-    return 0;
-}
-
-static void remote_control_write_byte_to_sequence(struct remote_control_benq_th534_data* rc_data, uint8_t byte) {
-    for (size_t i = 0; i < 8; ++i) {
-        bool is_bit_set = byte & (1 << i); // LSB first
-
-        if (is_bit_set) {
-            remote_control_write_slots_to_sequence(rc_data, NEC_SEQUENCE_ENCODED_1, sizeof(NEC_SEQUENCE_ENCODED_1));
-        } else {
-            remote_control_write_slots_to_sequence(rc_data, NEC_SEQUENCE_ENCODED_0, sizeof(NEC_SEQUENCE_ENCODED_0));
-        }
-    }
-}
-
-static void remote_control_write(struct remote_control_benq_th534_data* rc_data, uint8_t addr_low, uint8_t addr_high, uint8_t cmd) {
-	rc_data->seq_fill_index = 0; 
-
-    remote_control_write_slots_to_sequence(rc_data, NEC_SEQUENCE_ENCODED_AGC, sizeof(NEC_SEQUENCE_ENCODED_AGC));
-    remote_control_write_slots_to_sequence(rc_data, NEC_SEQUENCE_ENCODED_SPACE, sizeof(NEC_SEQUENCE_ENCODED_SPACE));
-    remote_control_write_byte_to_sequence(rc_data, addr_low);
-    remote_control_write_byte_to_sequence(rc_data, addr_high);
-    remote_control_write_byte_to_sequence(rc_data, cmd);
-    remote_control_write_byte_to_sequence(rc_data, ~cmd);
-    remote_control_write_slots_to_sequence(rc_data, NEC_SEQUENCE_ENCODED_STOP, sizeof(NEC_SEQUENCE_ENCODED_STOP));
-}
-
 static int remote_control_benq_th534_press_button(const struct device* dev, RemoteControlButton button)
 {
 	const struct remote_control_benq_th534_config* config = dev->config;
@@ -76,7 +33,12 @@ static int remote_control_benq_th534_press_button(const struct device* dev, Remo
     LOG_DBG("benq: press button");
 
     // Power on
-    remote_control_write(data, 0x0, 0x30, 0x4F);
+    int ret = nec_encode(0x0, 0x30, 0x4F, data->sequence, sizeof(data->sequence));
+    if (ret < 0) {
+        LOG_ERR("Sequence buffer overflow");
+        return ret;
+    }
+    data->seq_fill_index = ret;
 
     return ir_led_sequencer_send_burst(config->ir_led_sequencer, data->sequence, data->seq_fill_index, K_NSEC(562500), PWM_KHZ(38), PWM_NSEC(6575));
 }
@@ -7,12 +7,10 @@
 #include <zephyr/drivers/gpio.h>
 
 #include <drivers/remote_control.h>
+#include <remote_control_encoding/ev1527.h>
 
 LOG_MODULE_REGISTER(celexon_ev1527, CONFIG_REMOTE_CONTROL_LOG_LEVEL);
 
-#define TX_PACKET_BIT_LENGTH  24U
-#define PATTERN_LENGTH        4U
-#define PREAMBLE_LENGTH       32U
 #define BASE_TX_PERIOD        K_USEC(300)
 #define DEFAULT_RETRY_COUNT   5U
 
@@ -20,19 +18,9 @@ LOG_MODULE_REGISTER(celexon_ev1527, CONFIG_REMOTE_CONTROL_LOG_LEVEL);
 #define KEY_CODE_UP           4U
 #define KEY_CODE_STOP         16U
 
-typedef enum {
-    TX_STATE_IDLE = 0,
-    TX_STATE_PREAMBLE,
-    TX_STATE_DATA,
-} TxState;
-
 struct celexon_ev1527_data {
-    TxState tx_state;
-	uint32_t tx_data;
-    uint8_t tx_bit_index; // Bit index in tx_data
-    uint8_t pattern_index; // Signal pattern phase (0-3)
-
-    uint8_t preamble_index;
+    bool tx_sequence[EV1527_SEQUENCE_LENGTH];
+    uint8_t tx_slot_index; // Slot index in tx_sequence
 
     uint8_t remaining_retries;
 
@@ -49,17 +37,13 @@ static int celexon_ev1527_write(const struct device* dev, uint8_t key_code, uint
     const struct celexon_ev1527_config* config = dev->config;
     struct celexon_ev1527_data* data = dev->data;
 
-    //                      OTP code                  Data
-    data->tx_data = ((config->otp_code & 0xFFFFF) << 5) | key_code; // TODO: Something is wrong with the shift here. In theory, it should be 4 instead of 5 and the key_code should also have 4 bits
-    data->tx_bit_index = 0;
-    data->pattern_index = 0;
-
-    data->preamble_index = 0;
-    data->tx_state = TX_STATE_PREAMBLE;
+    uint32_t tx_data = ev1527_make_frame(config->otp_code, key_code);
+    ev1527_encode(tx_data, data->tx_sequence);
+    data->tx_slot_index = 0;
 
     data->remaining_retries = retry_count;
 
-    LOG_DBG("Write to celexon: %x", data->tx_data);
+    LOG_DBG("Write to celexon: %x", tx_data);
     k_timer_start(&data->tx_timer, K_NO_WAIT, BASE_TX_PERIOD);
 
     return 0;
@@ -68,47 +52,14 @@ static int celexon_ev1527_write(const struct device* dev, uint8_t key_code, uint
 static void celexon_ev1527_timer_expired(struct k_timer* timer) {
     struct celexon_ev1527_data* data = CONTAINER_OF(timer, struct celexon_ev1527_data, tx_timer);
 
-    if (data->tx_state == TX_STATE_PREAMBLE) {
-        if (data->preamble_index++ == 0) {
-            gpio_pin_set_dt(data->tx_pin, 1);
-        } else {
-            gpio_pin_set_dt(data->tx_pin, 0);
-        }
-
-        if (data->preamble_index >= PREAMBLE_LENGTH) {
-            data->tx_state = TX_STATE_DATA;
-        }
-        return;
-    }
-
-    bool active_tx_bit = data->tx_data & (1 << (TX_PACKET_BIT_LENGTH - data->tx_bit_index));
-    if (active_tx_bit == 0) {
-        if (data->pattern_index == 0) {
-            gpio_pin_set_dt(data->tx_pin, 1);
-        } else {
-            gpio_pin_set_dt(data->tx_pin, 0);
-        }
-    } else {
-        if (data->pattern_index < 3) {
-            gpio_pin_set_dt(data->tx_pin, 1);
-        } else {
-            gpio_pin_set_dt(data->tx_pin, 0);
-        }
-    }
-    
-    if (++data->pattern_index == PATTERN_LENGTH) {
-        ++data->tx_bit_index;
-        data->pattern_index = 0;
-    }
+    // The sequence is encoded upfront, so the expiry handler only replays it
+    gpio_pin_set_dt(data->tx_pin, data->tx_sequence[data->tx_slot_index]);
 
-    if (data->tx_bit_index >= TX_PACKET_BIT_LENGTH) {
+    if (++data->tx_slot_index >= EV1527_SEQUENCE_LENGTH) {
         if (data->remaining_retries > 0) {
             --data->remaining_retries;
-            data->tx_bit_index = 0;
-            data->preamble_index = 0;
-            data->tx_state = TX_STATE_PREAMBLE;
+            data->tx_slot_index = 0;
         } else {
-            data->tx_state = TX_STATE_IDLE;
             k_timer_stop(&data->tx_timer);
         }
     }
@@ -8,11 +8,12 @@
 
 #include <drivers/remote_control.h>
 #include <drivers/ir_led_sequencer.h>
+#include <remote_control_encoding/rc5.h>
 
 LOG_MODULE_REGISTER(remote_control_rc5, CONFIG_REMOTE_CONTROL_LOG_LEVEL);
 
 struct remote_control_rc5_data {
-	bool sequence[14*2];
+	bool sequence[RC5_SEQUENCE_LENGTH];
 };
 
 struct remote_control_rc5_config {
@@ -37,16 +38,11 @@ static int remote_control_rc5_press_button(const struct device *dev, RemoteContr
 
     static uint16_t toggle = 0;
 	toggle = !toggle;
-	uint16_t rc5_data = (cmd & 0x3f) | ((addr & 0x1f) << 6) | ((toggle & 1) << 11) | 0x1000 | 0x2000;
+	uint16_t rc5_data = rc5_make_frame(addr, cmd, toggle);
     LOG_DBG("rc5 data: %x\n (toggle: %u)", rc5_data, toggle);
 
-	size_t fill_index = 0;
-	for (int i = 0; i < 14; i++) {
-		bool bit = rc5_data & (1 << (13 - i));
-		data->sequence[fill_index++] = !bit;
-		data->sequence[fill_index++] = bit;
-	}
-	
+	rc5_encode(rc5_data, data->sequence);
+
 	return ir_led_sequencer_send_burst(config->ir_led_sequencer, data->sequence, sizeof(data->sequence), K_USEC(889), PWM_KHZ(36), PWM_NSEC(8333));
 }
 
@@ -0,0 +1,97 @@
+// Host microbenchmark of the remote control encoders.
+// Usage: remote_control_encoding_bench [frames per protocol]
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <remote_control_encoding/ev1527.h>
+#include <remote_control_encoding/nec.h>
+#include <remote_control_encoding/rc5.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define DEFAULT_FRAME_COUNT 10000000UL
+
+// Folded into the output so the compiler cannot drop the encoded frames
+static volatile uint32_t sink;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint32_t fold_sequence(const bool* sequence, size_t length) {
+    // Only sample the slots to keep the measurement dominated by the encoder
+    return sequence[0] + sequence[length / 2] + sequence[length - 1];
+}
+
+static uint64_t bench_nec(unsigned long frame_count) {
+    bool sequence[NEC_SEQUENCE_MAX_LENGTH];
+    uint32_t checksum = 0;
+
+    uint64_t start = now_ns();
+    for (unsigned long i = 0; i < frame_count; ++i) {
+        int length = nec_encode((uint8_t)i, (uint8_t)(i >> 8), (uint8_t)(i >> 16), sequence, sizeof(sequence));
+        checksum += fold_sequence(sequence, (size_t)length) + (uint32_t)length;
+    }
+    uint64_t elapsed = now_ns() - start;
+
+    sink = checksum;
+    return elapsed;
+}
+
+static uint64_t bench_rc5(unsigned long frame_count) {
+    bool sequence[RC5_SEQUENCE_LENGTH];
+    uint32_t checksum = 0;
+
+    uint64_t start = now_ns();
+    for (unsigned long i = 0; i < frame_count; ++i) {
+        rc5_encode(rc5_make_frame((uint8_t)i, (uint8_t)(i >> 5), i & 1), sequence);
+        checksum += fold_sequence(sequence, sizeof(sequence));
+    }
+    uint64_t elapsed = now_ns() - start;
+
+    sink = checksum;
+    return elapsed;
+}
+
+static uint64_t bench_ev1527(unsigned long frame_count) {
+    bool sequence[EV1527_SEQUENCE_LENGTH];
+    uint32_t checksum = 0;
+
+    uint64_t start = now_ns();
+    for (unsigned long i = 0; i < frame_count; ++i) {
+        ev1527_encode(ev1527_make_frame((uint32_t)i, (uint8_t)(i >> 20)), sequence);
+        checksum += fold_sequence(sequence, sizeof(sequence));
+    }
+    uint64_t elapsed = now_ns() - start;
+
+    sink = checksum;
+    return elapsed;
+}
+
+static void report(const char* protocol, unsigned long frame_count, uint64_t elapsed_ns) {
+    double ns_per_frame = (double)elapsed_ns / (double)frame_count;
+    double frames_per_second = ns_per_frame > 0.0 ? 1e9 / ns_per_frame : 0.0;
+
+    printf("%-8s %12lu frames %10.2f ns/frame %14.0f frames/s\n", protocol, frame_count, ns_per_frame, frames_per_second);
+}
+
+int main(int argc, char** argv) {
+    unsigned long frame_count = DEFAULT_FRAME_COUNT;
+    if (argc > 1) {
+        frame_count = strtoul(argv[1], NULL, 0);
+        if (frame_count == 0) {
+            fprintf(stderr, "usage: %s [frames per protocol]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    report("NEC", frame_count, bench_nec(frame_count));
+    report("RC5", frame_count, bench_rc5(frame_count));
+    report("EV1527", frame_count, bench_ev1527(frame_count));
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,106 @@
+// libFuzzer target: encodes fuzzer-chosen inputs and checks that the reference
+// decoders recover them. The first input byte selects the protocol.
+
+#include <remote_control_encoding/ev1527.h>
+#include <remote_control_encoding/nec.h>
+#include <remote_control_encoding/rc5.h>
+
+#include "reference_decoders.h"
+
+#include <errno.h>
+#include <stdlib.h>
+
+#define CHECK(cond)         \
+    do {                    \
+        if (!(cond)) {      \
+            abort();        \
+        }                   \
+    } while (0)
+
+static void fuzz_nec(const uint8_t* data, size_t size) {
+    if (size < 4) {
+        return;
+    }
+
+    const uint8_t addr_low = data[0];
+    const uint8_t addr_high = data[1];
+    const uint8_t cmd = data[2];
+    // Also exercise undersized buffers
+    const size_t sequence_len = data[3] % (NEC_SEQUENCE_MAX_LENGTH + 1);
+
+    bool sequence[NEC_SEQUENCE_MAX_LENGTH];
+    int length = nec_encode(addr_low, addr_high, cmd, sequence, sequence_len);
+    if (length < 0) {
+        CHECK(length == -ENOBUFS);
+
+        // The frame must really not fit
+        bool full_sequence[NEC_SEQUENCE_MAX_LENGTH];
+        int full_length = nec_encode(addr_low, addr_high, cmd, full_sequence, sizeof(full_sequence));
+        CHECK(full_length > 0 && (size_t)full_length > sequence_len);
+        return;
+    }
+
+    CHECK((size_t)length <= sequence_len);
+
+    uint8_t decoded_addr_low, decoded_addr_high, decoded_cmd;
+    CHECK(nec_decode(sequence, (size_t)length, &decoded_addr_low, &decoded_addr_high, &decoded_cmd));
+    CHECK(decoded_addr_low == addr_low);
+    CHECK(decoded_addr_high == addr_high);
+    CHECK(decoded_cmd == cmd);
+}
+
+static void fuzz_rc5(const uint8_t* data, size_t size) {
+    if (size < 3) {
+        return;
+    }
+
+    const uint8_t addr = data[0];
+    const uint8_t cmd = data[1];
+    const bool toggle = data[2] & 1;
+
+    bool sequence[RC5_SEQUENCE_LENGTH];
+    rc5_encode(rc5_make_frame(addr, cmd, toggle), sequence);
+
+    uint16_t frame;
+    CHECK(rc5_decode(sequence, sizeof(sequence), &frame));
+    CHECK((frame & 0x3f) == (cmd & 0x3f));
+    CHECK(((frame >> 6) & 0x1f) == (addr & 0x1f));
+    CHECK(((frame >> 11) & 1) == toggle);
+}
+
+static void fuzz_ev1527(const uint8_t* data, size_t size) {
+    if (size < 4) {
+        return;
+    }
+
+    const uint32_t otp_code = (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16);
+    const uint8_t key_code = data[3];
+    const uint32_t frame = ev1527_make_frame(otp_code, key_code);
+
+    bool sequence[EV1527_SEQUENCE_LENGTH];
+    ev1527_encode(frame, sequence);
+
+    uint32_t decoded_frame;
+    CHECK(ev1527_decode(sequence, sizeof(sequence), &decoded_frame));
+    CHECK(decoded_frame == (frame & 0x1FFFFFEUL));
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    if (size < 1) {
+        return 0;
+    }
+
+    switch (data[0] % 3) {
+        case 0:
+            fuzz_nec(data + 1, size - 1);
+            break;
+        case 1:
+            fuzz_rc5(data + 1, size - 1);
+            break;
+        case 2:
+            fuzz_ev1527(data + 1, size - 1);
+            break;
+    }
+
+    return 0;
+}
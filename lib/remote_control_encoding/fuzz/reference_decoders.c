@@ -0,0 +1,97 @@
+#include "reference_decoders.h"
+
+// Counts consecutive slots of the given level starting at *index
+static size_t count_run(const bool* sequence, size_t sequence_len, size_t* index, bool level) {
+    size_t run = 0;
+    while (*index < sequence_len && sequence[*index] == level) {
+        ++*index;
+        ++run;
+    }
+    return run;
+}
+
+bool nec_decode(const bool* sequence, size_t sequence_len, uint8_t* addr_low, uint8_t* addr_high, uint8_t* cmd) {
+    size_t index = 0;
+
+    // 9 ms AGC burst, 4.5 ms space
+    if (count_run(sequence, sequence_len, &index, true) != 16 || count_run(sequence, sequence_len, &index, false) != 8) {
+        return false;
+    }
+
+    uint32_t data = 0;
+    for (unsigned int bit = 0; bit < 32; ++bit) {
+        // Every bit starts with a 562.5 us pulse, the following space encodes the value
+        if (count_run(sequence, sequence_len, &index, true) != 1) {
+            return false;
+        }
+
+        size_t space = count_run(sequence, sequence_len, &index, false);
+        if (space == 3) {
+            data |= 1UL << bit; // LSB first
+        } else if (space != 1) {
+            return false;
+        }
+    }
+
+    // Stop bit terminates the frame
+    if (count_run(sequence, sequence_len, &index, true) != 1 || count_run(sequence, sequence_len, &index, false) != 1 || index != sequence_len) {
+        return false;
+    }
+
+    *addr_low = (uint8_t)data;
+    *addr_high = (uint8_t)(data >> 8);
+    *cmd = (uint8_t)(data >> 16);
+
+    // The last byte repeats the command inverted
+    return (uint8_t)(data >> 24) == (uint8_t)(*cmd ^ 0xFF);
+}
+
+bool rc5_decode(const bool* sequence, size_t sequence_len, uint16_t* frame) {
+    if (sequence_len != 28) {
+        return false;
+    }
+
+    uint16_t data = 0;
+    for (size_t i = 0; i < sequence_len; i += 2) {
+        // Manchester: a 1 is a low-to-high transition, a 0 a high-to-low transition
+        if (sequence[i] == sequence[i + 1]) {
+            return false;
+        }
+        data = (uint16_t)((data << 1) | sequence[i + 1]);
+    }
+
+    // Both start bits are always set
+    if ((data & 0x3000) != 0x3000) {
+        return false;
+    }
+
+    *frame = data;
+    return true;
+}
+
+bool ev1527_decode(const bool* sequence, size_t sequence_len, uint32_t* frame) {
+    if (sequence_len != 32 + 24 * 4) {
+        return false;
+    }
+
+    // Sync: a single high slot followed by 31 low slots
+    size_t index = 0;
+    if (count_run(sequence, sequence_len, &index, true) != 1 || count_run(sequence, 32, &index, false) != 31) {
+        return false;
+    }
+
+    uint32_t data = 0;
+    for (unsigned int bit = 0; bit < 24; ++bit) {
+        const bool* pattern = &sequence[32 + bit * 4];
+        if (pattern[0] && pattern[1] && pattern[2] && !pattern[3]) {
+            data = (data << 1) | 1;
+        } else if (pattern[0] && !pattern[1] && !pattern[2] && !pattern[3]) {
+            data = data << 1;
+        } else {
+            return false;
+        }
+    }
+
+    *frame = data << 1;
+    return true;
+}
@@ -0,0 +1,18 @@
+#ifndef REMOTE_CONTROL_ENCODING_REFERENCE_DECODERS_H_
+#define REMOTE_CONTROL_ENCODING_REFERENCE_DECODERS_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Straightforward decoders written against the protocol descriptions rather than
+// the encoder implementation. Each returns false if the sequence is malformed.
+
+bool nec_decode(const bool* sequence, size_t sequence_len, uint8_t* addr_low, uint8_t* addr_high, uint8_t* cmd);
+
+bool rc5_decode(const bool* sequence, size_t sequence_len, uint16_t* frame);
+
+// Yields bits 24 down to 1 of the transmitted packet (bit 0 is never sent)
+bool ev1527_decode(const bool* sequence, size_t sequence_len, uint32_t* frame);
+
+#endif /* REMOTE_CONTROL_ENCODING_REFERENCE_DECODERS_H_ */
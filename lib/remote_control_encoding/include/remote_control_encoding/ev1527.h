@@ -0,0 +1,41 @@
+#ifndef REMOTE_CONTROL_ENCODING_EV1527_H_
+#define REMOTE_CONTROL_ENCODING_EV1527_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Every bit is sent as a pattern of 4 slots (300 us each) after a preamble of 32 slots
+#define EV1527_PACKET_BIT_LENGTH    24U
+#define EV1527_PATTERN_LENGTH       4U
+#define EV1527_PREAMBLE_LENGTH      32U
+#define EV1527_SEQUENCE_LENGTH      (EV1527_PREAMBLE_LENGTH + EV1527_PACKET_BIT_LENGTH * EV1527_PATTERN_LENGTH)
+
+/**
+ * @brief Builds an EV1527 packet from the chip's OTP code and a key code
+ *
+ * @param otp_code 20 bit OTP code of the remote
+ * @param key_code Key code
+ *
+ * @return Packet to pass to ev1527_encode
+ */
+uint32_t ev1527_make_frame(uint32_t otp_code, uint8_t key_code);
+
+/**
+ * @brief Encodes an EV1527 packet (preamble and data bits) into GPIO slots
+ *
+ * Bits 24 down to 1 of the packet are transmitted, MSB first.
+ *
+ * @param frame Packet as returned by ev1527_make_frame
+ * @param sequence On/off sequence of EV1527_SEQUENCE_LENGTH slots to write into
+ */
+void ev1527_encode(uint32_t frame, bool sequence[EV1527_SEQUENCE_LENGTH]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REMOTE_CONTROL_ENCODING_EV1527_H_ */
@@ -0,0 +1,41 @@
+#ifndef REMOTE_CONTROL_ENCODING_NEC_H_
+#define REMOTE_CONTROL_ENCODING_NEC_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The NEC protocol uses pulse distance encoding, thus the sequences have a different length
+// and each sequence slot takes 562.5 us
+#define NEC_AGC_LENGTH      16U
+#define NEC_SPACE_LENGTH    8U
+#define NEC_BIT_0_LENGTH    2U
+#define NEC_BIT_1_LENGTH    4U
+#define NEC_STOP_LENGTH     2U
+
+/** @brief Upper bound of slots of an encoded frame (all 32 data bits set) */
+#define NEC_SEQUENCE_MAX_LENGTH (NEC_AGC_LENGTH + NEC_SPACE_LENGTH + NEC_BIT_1_LENGTH*8*4 + NEC_STOP_LENGTH)
+
+/**
+ * @brief Encodes an NEC frame (address, command and inverted command) into PWM slots
+ *
+ * @param addr_low Low address byte
+ * @param addr_high High address byte (extended NEC)
+ * @param cmd Command byte
+ * @param sequence On/off sequence of slots to write into
+ * @param sequence_len Capacity of the sequence buffer
+ *
+ * @retval Number of slots written if successful.
+ * @retval -ENOBUFS if the sequence buffer is too small.
+ */
+int nec_encode(uint8_t addr_low, uint8_t addr_high, uint8_t cmd, bool* sequence, size_t sequence_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REMOTE_CONTROL_ENCODING_NEC_H_ */
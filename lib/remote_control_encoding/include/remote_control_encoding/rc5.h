@@ -0,0 +1,38 @@
+#ifndef REMOTE_CONTROL_ENCODING_RC5_H_
+#define REMOTE_CONTROL_ENCODING_RC5_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// RC5 uses Manchester encoding: every bit takes two slots of 889 us
+#define RC5_FRAME_BIT_LENGTH    14U
+#define RC5_SEQUENCE_LENGTH     (RC5_FRAME_BIT_LENGTH * 2)
+
+/**
+ * @brief Builds a 14 bit RC5 frame (2 start bits, toggle bit, address, command)
+ *
+ * @param addr Device address (5 bits)
+ * @param cmd Command (6 bits)
+ * @param toggle Toggle bit, flipped on every new key press
+ *
+ * @return RC5 frame, MSB (first start bit) at bit 13
+ */
+uint16_t rc5_make_frame(uint8_t addr, uint8_t cmd, bool toggle);
+
+/**
+ * @brief Encodes an RC5 frame into PWM slots
+ *
+ * @param frame Frame as returned by rc5_make_frame
+ * @param sequence On/off sequence of RC5_SEQUENCE_LENGTH slots to write into
+ */
+void rc5_encode(uint16_t frame, bool sequence[RC5_SEQUENCE_LENGTH]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REMOTE_CONTROL_ENCODING_RC5_H_ */
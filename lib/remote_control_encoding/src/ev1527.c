@@ -0,0 +1,26 @@
+#include <remote_control_encoding/ev1527.h>
+
+#include <stddef.h>
+#include <string.h>
+
+uint32_t ev1527_make_frame(uint32_t otp_code, uint8_t key_code) {
+    //       OTP code                  Data
+    return ((otp_code & 0xFFFFF) << 5) | key_code; // TODO: Something is wrong with the shift here. In theory, it should be 4 instead of 5 and the key_code should also have 4 bits
+}
+
+void ev1527_encode(uint32_t frame, bool sequence[EV1527_SEQUENCE_LENGTH]) {
+    // Preamble: one high slot followed by a long low phase
+    sequence[0] = true;
+    memset(&sequence[1], false, (EV1527_PREAMBLE_LENGTH - 1) * sizeof(bool));
+
+    size_t fill_index = EV1527_PREAMBLE_LENGTH;
+    for (unsigned int i = 0; i < EV1527_PACKET_BIT_LENGTH; ++i) {
+        bool active_tx_bit = frame & (1UL << (EV1527_PACKET_BIT_LENGTH - i));
+
+        // 0: high for 1 slot, low for 3 slots; 1: high for 3 slots, low for 1 slot
+        sequence[fill_index++] = true;
+        sequence[fill_index++] = active_tx_bit;
+        sequence[fill_index++] = active_tx_bit;
+        sequence[fill_index++] = false;
+    }
+}
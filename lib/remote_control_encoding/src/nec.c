@@ -0,0 +1,59 @@
+#include <remote_control_encoding/nec.h>
+
+#include <errno.h>
+#include <string.h>
+
+static const bool NEC_SEQUENCE_ENCODED_0[NEC_BIT_0_LENGTH] = {true, false};
+static const bool NEC_SEQUENCE_ENCODED_1[NEC_BIT_1_LENGTH] = {true, false, false, false};
+static const bool NEC_SEQUENCE_ENCODED_STOP[NEC_STOP_LENGTH] = {true, false};
+
+static int nec_write_slots(bool* sequence, size_t sequence_len, size_t* fill_index, const bool* slots, size_t length) {
+    if (*fill_index + length > sequence_len) {
+        return -ENOBUFS;
+    }
+
+    memcpy(&sequence[*fill_index], slots, length * sizeof(bool));
+    *fill_index += length;
+    return 0;
+}
+
+static int nec_write_byte(bool* sequence, size_t sequence_len, size_t* fill_index, uint8_t byte) {
+    for (size_t i = 0; i < 8; ++i) {
+        bool is_bit_set = byte & (1 << i); // LSB first
+
+        int ret = is_bit_set
+            ? nec_write_slots(sequence, sequence_len, fill_index, NEC_SEQUENCE_ENCODED_1, sizeof(NEC_SEQUENCE_ENCODED_1))
+            : nec_write_slots(sequence, sequence_len, fill_index, NEC_SEQUENCE_ENCODED_0, sizeof(NEC_SEQUENCE_ENCODED_0));
+        if (ret < 0) {
+            return ret;
+        }
+    }
+
+    return 0;
+}
+
+int nec_encode(uint8_t addr_low, uint8_t addr_high, uint8_t cmd, bool* sequence, size_t sequence_len) {
+    if (sequence_len < NEC_AGC_LENGTH + NEC_SPACE_LENGTH) {
+        return -ENOBUFS;
+    }
+
+    // AGC burst followed by a space
+    memset(sequence, true, NEC_AGC_LENGTH * sizeof(bool));
+    memset(&sequence[NEC_AGC_LENGTH], false, NEC_SPACE_LENGTH * sizeof(bool));
+    size_t fill_index = NEC_AGC_LENGTH + NEC_SPACE_LENGTH;
+
+    const uint8_t bytes[] = {addr_low, addr_high, cmd, (uint8_t)~cmd};
+    for (size_t i = 0; i < sizeof(bytes); ++i) {
+        int ret = nec_write_byte(sequence, sequence_len, &fill_index, bytes[i]);
+        if (ret < 0) {
+            return ret;
+        }
+    }
+
+    int ret = nec_write_slots(sequence, sequence_len, &fill_index, NEC_SEQUENCE_ENCODED_STOP, sizeof(NEC_SEQUENCE_ENCODED_STOP));
+    if (ret < 0) {
+        return ret;
+    }
+
+    return (int)fill_index;
+}
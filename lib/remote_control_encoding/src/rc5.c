@@ -0,0 +1,16 @@
+#include <remote_control_encoding/rc5.h>
+
+#include <stddef.h>
+
+uint16_t rc5_make_frame(uint8_t addr, uint8_t cmd, bool toggle) {
+    return (cmd & 0x3f) | ((addr & 0x1f) << 6) | ((toggle & 1) << 11) | 0x1000 | 0x2000;
+}
+
+void rc5_encode(uint16_t frame, bool sequence[RC5_SEQUENCE_LENGTH]) {
+    size_t fill_index = 0;
+    for (unsigned int i = 0; i < RC5_FRAME_BIT_LENGTH; i++) {
+        bool bit = frame & (1 << (RC5_FRAME_BIT_LENGTH - 1 - i));
+        sequence[fill_index++] = !bit;
+        sequence[fill_index++] = bit;
+    }
+}